@@ -69,11 +69,16 @@ protected:
   double solveLinearizedSystem(double lambda, int iter = 0);
 
 private:
-  double arclen; //!< Arc-length parameter
-  double beta;   //!< Arc-length parameter
+  double arclen;  //!< Arc-length parameter
+  double beta;    //!< Arc-length parameter
+  bool   keepTan; //!< If \e true, reuse the tangent solution in modified Newton
 
   Vector tansol; //!< Tangential displacement vector
   Vector incsol; //!< Incremental solution of previous load step
+
+  double convTol;   //!< Convergence tolerance of current load step
+  double prevNorm;  //!< Convergence norm of the previous iteration
+  int    nIncrease; //!< Number of iterations with increasing norm
 };
 
 #endif
@@ -0,0 +1,79 @@
+// $Id$
+//==============================================================================
+//!
+//! \file AsyncOutput.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Background thread for result output tasks.
+//!
+//==============================================================================
+
+#ifndef _ASYNC_OUTPUT_H
+#define _ASYNC_OUTPUT_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+
+/*!
+  \brief Class executing output tasks on a background I/O thread.
+  \details The tasks are executed in the order they are queued. Each task
+  should only operate on data that has been copied into the task itself,
+  such that the caller can proceed with the next time or load step while the
+  task runs. At most \a maxTasks tasks can be pending at any time. When the
+  queue is full, push() blocks until the oldest task has finished, which keeps
+  the memory consumption bounded. The destructor waits for all pending tasks.
+
+  In parallel (MPI) runs, the file output may involve collective operations,
+  which have to be invoked from the main thread in the same order on all
+  processes. The tasks are then executed directly by push() instead.
+*/
+
+class AsyncOutput
+{
+public:
+  //! \brief Type of a task, returning \e false on failure.
+  typedef std::function<bool()> Task;
+
+  //! \brief The constructor initializes the queue size.
+  //! \param[in] maxTasks Max number of pending tasks (2 means double buffered)
+  //! \param[in] threaded If \e false, the tasks are executed by push()
+  explicit AsyncOutput(size_t maxTasks = 2, bool threaded = true);
+  //! \brief The destructor waits for all pending tasks to finish.
+  ~AsyncOutput();
+
+  //! \brief Queues a task for execution on the I/O thread.
+  //! \return \e false if a previously executed task has failed
+  bool push(const Task& task);
+  //! \brief Waits until all pending tasks have finished.
+  //! \return \e false if any of the executed tasks have failed
+  bool flush();
+
+  //! \brief Returns the mutex serializing the calls to the HDF5 library.
+  //! \details The mutex has to be locked by the tasks and by the caller
+  //! around all HDF5 file access, since the library is not thread-safe.
+  std::mutex& hdf5Mutex() { return h5mtx; }
+
+private:
+  //! \brief The I/O thread loop.
+  void run();
+
+  std::thread       worker;  //!< The background I/O thread
+  std::mutex        mtx;     //!< Mutex protecting the task queue
+  std::mutex        h5mtx;   //!< Mutex serializing the HDF5 file access
+  std::condition_variable cv; //!< Task queue state notification
+  std::deque<Task>  tasks;   //!< Pending tasks
+  size_t            maxSize; //!< Max number of pending tasks
+  bool              async;   //!< If \e true, use the background I/O thread
+  bool              busy;    //!< If \e true, a task is currently executing
+  bool              stop;    //!< If \e true, the I/O thread should terminate
+  bool              failed;  //!< If \e true, an executed task has failed
+};
+
+#endif
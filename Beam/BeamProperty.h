@@ -15,6 +15,7 @@
 #define _BEAM_PROPERTY_H
 
 #include <iostream>
+#include <vector>
 
 class Vec3;
 class RealFunc;
@@ -41,14 +42,23 @@ public:
   static bool parseBox(const tinyxml2::XMLElement* prop, double& A,
                        double& Iy, double& Iz);
 
+  //! \brief Allocates the table of precomputed section properties.
+  //! \param[in] nel Number of elements in the model
+  //! \details The table is used only when the properties are read from a
+  //! CSV-file, since these are functions of the spatial coordinates only.
+  //! The property functions are then evaluated only once for each element,
+  //! the first time it is integrated.
+  void initTable(size_t nel);
+
   //! \brief Evaluates the beam properties at the specified point \a X.
+  //! \param[in] iel Global element number (1-based) for table lookup
   void eval(const Vec3& X, double L, double E, double G, double rho,
             bool hasGrav, bool hasMass,
             double& EA,   double& EI_y, double& EI_z,
             double& GI_t, double& Al_y, double& Al_z,
             double& rhoA, double& CG_y, double& CG_z,
             double& I_xx, double& I_yy, double& I_zz,
-            double& ItoA, double& S_y,  double& S_z) const;
+            double& ItoA, double& S_y,  double& S_z, size_t iel = 0) const;
   //! \brief Evaluates the beam properties at the specified point \a X.
   void eval(const Vec3& X, double E, double G, double rho,
             double& EA, double& EI_y, double& EI_z, double& GI_t,
@@ -69,6 +79,17 @@ protected:
   //! \brief Reads beam cross section properties from a CSV-file.
   bool readCSV(const char* fileName);
 
+private:
+  //! \brief Indices of the section property functions read from CSV-file.
+  enum TableFunc { TAB_AX, TAB_AY, TAB_AZ, TAB_IX, TAB_IY, TAB_IZ,
+                   TAB_SY, TAB_SZ, NTAB };
+
+  //! \brief Evaluates the section property functions at a point.
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[in] iel Global element number (1-based) for table lookup
+  //! \param[out] fv Function values, indexed by TableFunc
+  void evalFuncs(const Vec3& X, size_t iel, double* fv) const;
+
 private:
   RealFunc* EAfunc;  //!< Axial stiffness
   RealFunc* EIyfunc; //!< Bending stiffness about local Y-axis
@@ -86,6 +107,11 @@ private:
   RealFunc* CGyfunc; //!< Mass center location along local Y-axis
   RealFunc* CGzfunc; //!< Mass center location along local Z-axis
 
+  bool fromCSV; //!< If \e true, the property functions are read from CSV-file
+
+  mutable std::vector<double> tabVal[NTAB]; //!< Tabulated function values
+  mutable std::vector<char>   tabDone; //!< Flags for the tabulated elements
+
 public:
   double A;  //!< Cross section area
   double Ix; //!< Second area moment around local X-axis
@@ -16,6 +16,7 @@
 
 #include "SIM1D.h"
 #include "SIMRigid.h"
+#include "SpatialIndex.h"
 
 
 /*!
@@ -44,6 +45,8 @@ protected:
   //! if \a onElement is \e true.
   //! \param[in] onElement If \e true, always find an element containing the
   //! specified point, even if it exactly matches a node (control point).
+  //! \details The closest node is looked up through the spatial index
+  //! \ref myNodes, if it has been built, otherwise all nodes are searched.
   //! \return 1-based patch-local index of the matching node, if positive.
   //! 1-based index of the element containing the point, if negative.
   //! If zero, an error condition occurred.
@@ -55,6 +58,8 @@ protected:
   //! \param[in] f Load magnitude
   //! \param[in] ldof Coordinate direction of the load
   bool assemblePoint(int patch, double u, double f, int ldof = 1);
+
+  SpatialIndex myNodes; //!< Spatial index of the nodal points
 };
 
 #endif
@@ -76,6 +76,10 @@ protected:
   //! \brief Initializes beam properties for integration of interior terms.
   //! \param[in] propInd Physical property index
   virtual bool initMaterial(size_t propInd);
+  //! \brief Initializes the body load properties for current patch.
+  //! \param[in] patchInd 1-based patch index
+  //! \details Reimplemented only to set the current patch of the timers.
+  virtual bool initBodyLoad(size_t patchInd);
   //! \brief Initializes for integration of Neumann terms for a given property.
   //! \param[in] propInd Physical property index
   virtual bool initNeumann(size_t propInd);
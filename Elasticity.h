@@ -23,6 +23,7 @@ class Tensor;
 class SymmTensor;
 class TractionFunc;
 class FunctionBase;
+class GaussPointWriter;
 
 
 /*!
@@ -83,6 +84,11 @@ public:
 
   //! \brief Defines the local coordinate system for stress output.
   void setLocalSystem(LocalSystem* cs) { locSys = cs; }
+  //! \brief Defines a streaming writer for the secondary solution points.
+  //! \details When set, the secondary solution values at each evaluation
+  //! point of evalSol2() are passed on to the writer, instead of being kept
+  //! in memory. Use \e nullptr to detach the writer again.
+  void setGaussPointWriter(GaussPointWriter* w) { gpWriter = w; }
 
   using ElasticBase::initIntegration;
   //! \brief Initializes the integrand with the number of integration points.
@@ -207,6 +213,10 @@ public:
 
   //! \brief Returns the number of primary/secondary solution field components.
   //! \param[in] fld which field set to consider (1=primary, 2=secondary)
+  //!
+  //! \details When a solution batch is active, see setSolutionBatch(),
+  //! the number of secondary field components of all the solutions is
+  //! returned for \a fld = 2.
   virtual size_t getNoFields(int fld = 2) const;
   //! \brief Returns the name of a primary solution field component.
   //! \param[in] i Field component index
@@ -228,7 +238,7 @@ public:
   void initMaxVals(size_t nP = 1);
 
   //! \brief Returns a pointer to the max values for external update.
-  std::vector<PointValues>* getMaxVals() const { return &maxVal; }
+  std::vector<PointValues>* getMaxVals() const;
 
   //! \brief Prints out the maximum secondary solution values to the log stream.
   //! \param[in] precision Number of digits after the decimal point
@@ -236,6 +246,21 @@ public:
   void printMaxVals(std::streamsize precision, size_t comp = 0) const;
 
 protected:
+  //! \brief Scratch buffers for the integration point calculations.
+  //! \details Each thread owns one instance, which is kept alive across
+  //! integration points and elements. The buffers are thus only reallocated
+  //! when they need to grow, such that steady-state assembly does not allocate.
+  struct Workspace
+  {
+    Matrix Bmat; //!< Strain-displacement matrix
+    Matrix Cmat; //!< Constitutive matrix
+    Matrix CB;   //!< Constitutive matrix times strain-displacement matrix
+    Matrix dUdX; //!< Displacement gradient
+  };
+
+  //! \brief Returns the scratch workspace of the calling thread.
+  static Workspace& workspace();
+
   //! \brief Calculates some kinematic quantities at current point.
   //! \param[in] eV Element solution vector
   //! \param[in] N Basis function values at current point
@@ -309,6 +334,16 @@ protected:
   virtual bool evalSol2(Vector& s, const Vectors& eV,
                         const FiniteElement& fe, const Vec3& X) const;
 
+  //! \brief Evaluates the stress result quantities from the stress tensor.
+  //! \param[out] s The stress values at current point
+  //! \param sigma The stress tensor at current point
+  //! \param[in] X Cartesian coordinates of current point
+  //! \param[in] toLocal If \e true, transform to local coordinates (if defined)
+  //! and append the von Mises and principal stresses
+  //! \param[out] pdir Directions of the principal stresses (optional)
+  bool stressResults(Vector& s, SymmTensor& sigma, const Vec3& X,
+                     bool toLocal, Vec3* pdir) const;
+
   //! \brief Performs pull-back of traction (interface for nonlinear problems).
   virtual bool pullBackTraction(Vec3&) const { return true; }
 
@@ -331,6 +366,15 @@ public:
   //! \brief Enable or disable max value calculation.
   void enableMaxValCalc(bool onOrOff) const { calcMaxVal = onOrOff; }
 
+  //! \brief Enables secondary solution evaluation for a batch of solutions.
+  //! \param[in] n Number of primary solutions in the batch (0 to disable)
+  //!
+  //! \details When enabled, the secondary solution of each of the \a n
+  //! primary solution vectors is evaluated in each point, one after another.
+  //! This allows a single projection pass for several solutions, e.g.,
+  //! a set of eigenmodes. This method must be invoked after setMode().
+  void setSolutionBatch(size_t n);
+
 protected:
   // Physical properties
   Material*     material; //!< Material data and constitutive relation
@@ -339,18 +383,25 @@ protected:
   VecFunc*      fluxFld;  //!< Pointer to explicit boundary traction field
   VecFunc*      bodyFld;  //!< Pointer to body force field
   Vec3Vec*      pDirBuf;  //!< Principal stress directions buffer
+  GaussPointWriter* gpWriter; //!< Streaming integration point output
 
   FunctionBase*              dualRHS; //!< Extraction function for dual RHS
   std::vector<FunctionBase*> dualFld; //!< Extraction functions for VCP
 
   mutable std::vector<PointValues> maxVal;  //!< Maximum result values
+  //! Thread-local maximum result values, merged into \ref maxVal on demand
+  mutable std::vector< std::vector<PointValues> > thrMaxVal;
   mutable std::vector<Vec3Pair>    tracVal; //!< Traction field point values
 
   unsigned short int nDF; //!< Dimension on deformation gradient (2 or 3)
   bool       axiSymmetry; //!< If \e true, the problem is axi-symmetric
   double           gamma; //!< Numeric stabilization parameter
+  size_t          nBatch; //!< Number of primary solutions in current batch
 
 private:
+  //! \brief Merges the thread-local maximum values into \ref maxVal.
+  void mergeMaxVals() const;
+
   mutable bool calcMaxVal; //!< If \e true, max result values are calculated
   GlobalIntegral* myReacI; //!< Reaction-forces-only integral
 
@@ -0,0 +1,84 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ElmMatrixCache.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Compact buffer of symmetric element matrices.
+//!
+//==============================================================================
+
+#ifndef _ELM_MATRIX_CACHE_H
+#define _ELM_MATRIX_CACHE_H
+
+#include "MatVec.h"
+#include <atomic>
+
+
+/*!
+  \brief Class representing a buffer of symmetric element matrices.
+  \details Only the upper triangle of each element matrix is stored,
+  optionally in single precision. The total size of the buffer can be limited
+  by a memory budget. Elements that do not fit within the budget are not
+  buffered, and their element matrices then have to be recomputed.
+  The store() method may be invoked concurrently for different elements.
+*/
+
+class ElmMatrixCache
+{
+public:
+  //! \brief Default constructor.
+  ElmMatrixCache() : maxBytes(0), single(false), used(0), nHit(0), nMiss(0) {}
+
+  //! \brief Defines the memory budget of the buffer.
+  //! \param[in] mBytes Max size of the buffer in MBytes (0 means unlimited)
+  //! \param[in] sp If \e true, store the matrices in single precision
+  void setBudget(double mBytes, bool sp);
+
+  //! \brief Allocates the buffer for a given number of elements.
+  //! \param[in] nEl Number of elements in the model
+  void init(size_t nEl);
+  //! \brief Removes all buffered matrices, keeping the number of elements.
+  void clear() { this->init(nrow.size()); }
+
+  //! \brief Returns \e true if the buffer has not been allocated.
+  bool empty() const { return nrow.empty(); }
+  //! \brief Returns \e true if the matrix of the given element is buffered.
+  //! \param[in] iel 0-based element index
+  bool has(size_t iel) const { return iel < nrow.size() && nrow[iel] > 0; }
+
+  //! \brief Stores the upper triangle of an element matrix.
+  //! \param[in] iel 0-based element index
+  //! \param[in] A The symmetric element matrix to store
+  //! \return \e false if the matrix did not fit within the memory budget
+  bool store(size_t iel, const Matrix& A);
+  //! \brief Restores a full element matrix from the buffer.
+  //! \param[in] iel 0-based element index
+  //! \param[out] A The restored element matrix
+  //! \return \e false if the element is not buffered (a cache miss)
+  bool restore(size_t iel, Matrix& A);
+
+  //! \brief Returns the current size of the buffer (in bytes).
+  size_t size() const { return used; }
+  //! \brief Returns the number of cache hits.
+  size_t hits() const { return nHit; }
+  //! \brief Returns the number of cache misses.
+  size_t misses() const { return nMiss; }
+
+private:
+  std::vector<size_t>   nrow; //!< Element matrix dimensions (0 if not stored)
+  std::vector<RealArray> dbl; //!< Double precision upper triangles
+  std::vector< std::vector<float> > flt; //!< Single precision upper triangles
+
+  size_t maxBytes; //!< Memory budget in bytes (0 means unlimited)
+  bool   single;   //!< If \e true, store the matrices in single precision
+
+  std::atomic<size_t> used;  //!< Current buffer size in bytes
+  std::atomic<size_t> nHit;  //!< Number of cache hits
+  std::atomic<size_t> nMiss; //!< Number of cache misses
+};
+
+#endif
@@ -0,0 +1,103 @@
+// $Id$
+//==============================================================================
+//!
+//! \file GaussPointTimer.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Gauss-point level timers and counters for the integrands.
+//!
+//==============================================================================
+
+#ifndef _GAUSS_POINT_TIMER_H
+#define _GAUSS_POINT_TIMER_H
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace utl { class LogStream; }
+
+
+/*!
+  \brief Gauss-point level timers and counters for the elasticity integrands.
+  \details The instrumented sections are timed each time they are entered,
+  and the number of calls, the elapsed time and the number of heap allocations
+  are accumulated per thread and per patch. The times are inclusive, i.e.,
+  the time of the material evaluation is also included in the time of the
+  integrand calling it.
+
+  The instrumentation is compiled in only when the macro \a HAS_GP_TIMING is
+  defined (cmake option \a ENABLE_GP_TIMING). Otherwise, the GP_TIMER macro
+  expands to nothing, such that the optimized integrands carry no overhead.
+  When compiled in, the timers are started only if \a active is \e true.
+*/
+
+class GaussPointTimer
+{
+public:
+  //! \brief The instrumented sections.
+  enum Section
+  {
+    LINEL,      //!< LinearElasticity::evalInt()
+    KINEMATICS, //!< Elasticity::kinematics()
+    MATERIAL,   //!< Material::evaluate()
+    MATPROD,    //!< Element matrix products in LinearElasticity::evalInt()
+    BEAM,       //!< ElasticBeam::evalInt()
+    PLATE,      //!< KirchhoffLovePlate::evalInt()
+    SHELL,      //!< KirchhoffLoveShell::evalInt() and NLKirchhoffLoveShell
+    NSECTION    //!< Number of instrumented sections
+  };
+
+  //! \brief Helper class timing a section during the lifetime of the object.
+  class Scope
+  {
+  public:
+    //! \brief The constructor starts the timer for the given section.
+    explicit Scope(Section s);
+    //! \brief The destructor stops the timer and accumulates the counters.
+    ~Scope();
+
+  private:
+    Section     sec;    //!< The section being timed
+    bool        on;     //!< If \e true, the timer was started
+    std::size_t nAlloc; //!< Allocation count of this thread at start time
+    std::chrono::steady_clock::time_point start; //!< Start time
+  };
+
+  //! \brief Defines the patch to accumulate the subsequent counters for.
+  //! \param[in] patch 1-based patch index
+  static void setPatch(std::size_t patch);
+  //! \brief Resets all counters to zero.
+  static void clear();
+  //! \brief Prints out the accumulated counters.
+  //! \param os The log stream to print to
+  static void report(utl::LogStream& os);
+  //! \brief Returns the accumulated integrand time of each patch.
+  //! \param[out] seconds Elapsed time [s] of each patch, in patch order
+  //! \return \e false if no patch-wise times have been recorded
+  //!
+  //! \details Only the outermost integrand sections are accounted for, since
+  //! the times of the nested sections are included in those.
+  static bool getPatchTimes(std::vector<double>& seconds);
+
+  static bool active; //!< If \e true, the timers are started
+
+private:
+  //! \brief Accumulates the counters for the current thread and patch.
+  static void add(Section s, long long ns, std::size_t nalloc);
+};
+
+#ifdef HAS_GP_TIMING
+//! \brief Times the section \a sec until the end of the current scope.
+#define GP_TIMER(sec) GaussPointTimer::Scope gpTimer(GaussPointTimer::sec)
+//! \brief Sets the current patch of the Gauss-point timers.
+#define GP_TIMER_PATCH(patch) GaussPointTimer::setPatch(patch)
+#else
+#define GP_TIMER(sec)
+#define GP_TIMER_PATCH(patch)
+#endif
+
+#endif
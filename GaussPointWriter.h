@@ -0,0 +1,101 @@
+// $Id$
+//==============================================================================
+//!
+//! \file GaussPointWriter.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Streaming output of integration point results to a binary file.
+//!
+//==============================================================================
+
+#ifndef _GAUSS_POINT_WRITER_H
+#define _GAUSS_POINT_WRITER_H
+
+#include "AsyncOutput.h"
+#include "MatVec.h"
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Vec3;
+
+
+/*!
+  \brief Class writing integration point results to a chunked binary file.
+  \details The results are collected in one buffer per thread, and each
+  buffer is written as a chunk to the file on a background I/O thread when
+  it is full. The memory consumption is therefore bounded by the chunk size
+  and the number of threads, and not by the model size.
+
+  The file consists of a header followed by any number of chunks:
+  - Header: The 8 characters \a "IFEMGP01", the number of result components
+    \a nc as a 32-bit integer, and the \a nc component names, each as a
+    32-bit length followed by the characters.
+  - Chunk: The number of points \a np as a 64-bit integer, followed by
+    \a np 32-bit element numbers, \a np 64-bit integration point indices,
+    and \a np*(3+nc) doubles with the coordinates and result values of
+    each point.
+
+  The chunks are not ordered, since they are written as the threads fill
+  their buffers. Each point is therefore identified by its element number
+  and its global integration point index.
+*/
+
+class GaussPointWriter
+{
+public:
+  //! \brief The constructor initializes the chunk size.
+  //! \param[in] chunkSize Number of points of each chunk
+  explicit GaussPointWriter(size_t chunkSize = 65536);
+  //! \brief The destructor flushes the buffers and closes the file.
+  ~GaussPointWriter();
+
+  //! \brief Opens the file and writes the header.
+  //! \param[in] fileName Name of the file to write
+  //! \param[in] names Names of the result components
+  bool open(const std::string& fileName, const std::vector<std::string>& names);
+  //! \brief Writes the remaining buffers and closes the file.
+  bool close();
+
+  //! \brief Adds the results of an integration point.
+  //! \param[in] iel Global element number (1-based)
+  //! \param[in] iGP Global integration point index (0-based)
+  //! \param[in] X Cartesian coordinates of the integration point
+  //! \param[in] s Result values at the integration point
+  //!
+  //! \details This method is thread-safe, and may be invoked concurrently
+  //! from the threads of the multi-threaded element loop. Points with a
+  //! different number of values than the number of result components,
+  //! e.g., singular points, are ignored.
+  bool add(int iel, size_t iGP, const Vec3& X, const Vector& s);
+
+  //! \brief Returns the number of points written so far.
+  size_t size() const { return nPoints; }
+
+private:
+  //! \brief Buffered results of one thread.
+  struct Chunk
+  {
+    std::vector<int>    elm; //!< Element numbers
+    std::vector<size_t> igp; //!< Integration point indices
+    std::vector<double> val; //!< Coordinates and result values
+  };
+
+  //! \brief Queues the chunk of a thread for output.
+  bool write(std::unique_ptr<Chunk>& chunk);
+
+  FILE*  fd;      //!< The output file
+  size_t nComp;   //!< Number of result components
+  size_t maxSize; //!< Number of points of each chunk
+  size_t nPoints; //!< Number of points queued for output
+
+  std::vector< std::unique_ptr<Chunk> > thrBuf; //!< Per-thread buffers
+
+  AsyncOutput io; //!< Background I/O thread
+};
+
+#endif
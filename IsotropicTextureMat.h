@@ -15,8 +15,6 @@
 #define _ISOTROPIC_TEXTURE_MAT_H
 
 #include "LinIsotropic.h"
-#include <array>
-#include <map>
 
 
 /*!
@@ -29,7 +27,10 @@ public:
   //! \brief The constructor forwards to the parent class constructor.
   //! \param[in] ps If \e true, assume plane stress in 2D
   //! \param[in] ax If \e true, assume 3D axi-symmetric material
-  IsotropicTextureMat(bool ps, bool ax) : LinIsotropic(ps,ax) {}
+  IsotropicTextureMat(bool ps, bool ax) : LinIsotropic(ps,ax)
+  {
+    nrow = ncol = 0;
+  }
   //! \brief Empty destructor.
   virtual ~IsotropicTextureMat() = default;
 
@@ -39,6 +40,9 @@ public:
   //! \brief Prints out material parameters to the log stream.
   void printLog() const override;
 
+  //! \brief Returns \e false since the material varies through the texture.
+  bool isHomogeneous() const override { return false; }
+
   //! \brief Evaluates the constitutive relation at an integration point.
   //! \param[out] C Constitutive matrix at current point
   //! \param[out] sigma Stress tensor at current point
@@ -71,12 +75,16 @@ private:
 
 protected:
   typedef std::pair<double,double> Doubles; //!< Convenience type
-  typedef std::array<double,4>     rgba;    //!< RGB color code
 
-  //! Material for different texture regions
-  std::map< Doubles,LinIsotropic > materials;
-  //! Raw image texture information describing the spatial material variation
-  std::vector< std::vector<rgba> > textureData;
+  std::vector<Doubles>      ranges;    //!< Texture range of each material
+  std::vector<LinIsotropic> materials; //!< Material for each texture range
+
+  //! \brief 1-based material index of each texture pixel, row by row.
+  //! \details A zero value means the pixel is not covered by any range.
+  std::vector<unsigned short> textureData;
+
+  int nrow; //!< Number of texture pixels in the first parameter direction
+  int ncol; //!< Number of texture pixels in the second parameter direction
 };
 
 #endif
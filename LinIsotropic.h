@@ -43,7 +43,8 @@ public:
     : Efunc(nullptr), Efield(nullptr), Emod(E), nuFunc(nullptr), nu(v),
       rhoFunc(nullptr), rho(densty),
       Cpfunc(nullptr), heatcapacity(0.0), Afunc(nullptr), alpha(0.0),
-      condFunc(nullptr), conductivity(0.0), planeStress(ps), axiSymmetry(ax) {}
+      condFunc(nullptr), conductivity(0.0), planeStress(ps), axiSymmetry(ax)
+  { this->initConstitutive(); }
   //! \brief Constructor initializing the material parameters.
   //! \param[in] E Young's modulus (spatial function)
   //! \param[in] v Poisson's ratio
@@ -69,8 +70,16 @@ public:
   //! \brief Prints out material parameters to the log stream.
   virtual void printLog() const;
 
+  //! \brief Assigns a new value to a named material parameter.
+  //! \param[in] name Parameter name, \a "E", \a "nu" or \a "rho"
+  //! \param[in] value The new parameter value
+  //! \return \e false if the parameter is unknown or defined by a function
+  virtual bool setParameter(const char* name, double value);
+
   //! \brief Returns \e false if plane stress in 2D.
   virtual bool isPlaneStrain() const { return !planeStress; }
+  //! \brief Returns \e true if the stiffness is constant in space.
+  virtual bool isHomogeneous() const { return !Efunc && !Efield && !nuFunc; }
 
   //! \brief Evaluates the stiffness at current point.
   virtual double getStiffness(const Vec3& X) const;
@@ -117,6 +126,20 @@ public:
   const Field* getEfield() const { return Efield; }
 
 protected:
+  //! \brief Calculates the constitutive matrix for given material parameters.
+  //! \param[out] C The constitutive matrix (or its inverse)
+  //! \param[in] nsd Number of spatial dimensions (2 or 3)
+  //! \param[in] E Young's modulus
+  //! \param[in] v Poisson's ratio
+  //! \param[in] inverse If \e true, calculate the inverse constitutive matrix
+  void formCmat(Matrix& C, size_t nsd, double E, double v, bool inverse) const;
+
+  //! \brief Precomputes the constitutive matrices for constant Poisson's ratio.
+  //! \details Must be invoked whenever \a nu or the plane stress/axi-symmetry
+  //! options are changed. The matrices are computed for unit stiffness,
+  //! such that they also can be used for spatially varying Young's modulus.
+  void initConstitutive();
+
   // Material properties
   RealFunc* Efunc;      //!< Young's modulus (spatial function)
   Field*    Efield;     //!< Young's modulus (spatial field)
@@ -133,6 +156,10 @@ protected:
   double conductivity;  //!< Thermal conductivity (constant)
   bool   planeStress;   //!< Plane stress/strain option for 2D problems
   bool   axiSymmetry;   //!< Axi-symmetric option
+
+private:
+  Matrix Cunit[2]; //!< Constitutive matrices for E=1 in 2D and 3D
+  Matrix Cinvu[2]; //!< Inverse constitutive matrices for E=1 in 2D and 3D
 };
 
 #endif
@@ -213,10 +213,10 @@ class NavierPlate : public ThinPlateSol, private STensorFunc
   {
   public:
     //! \brief The constructor initializes the problem parameters.
-    Displ(double p, double a, double b, double x, double y,
-          double c, double d, char t, int n, int i)
-      : pzD(p), alpha(a), beta(b), xi(x), eta(y), c2(c), d2(d),
-        type(t), mn(t > 0 ? n : n-1), inc(i) {}
+    Displ(double p, double a, double b, const std::vector<double>& fa,
+          const std::vector<double>& fb, size_t n, char t, int i)
+      : pzD(p), alpha(a), beta(b), fx(fa.begin(),fa.begin()+n),
+        fy(fb.begin(),fb.begin()+n), type(t), inc(i) {}
     //! \brief Empty destructor.
     virtual ~Displ() {}
 
@@ -229,23 +229,21 @@ class NavierPlate : public ThinPlateSol, private STensorFunc
     double alpha; //!< pi/(plate length)
     double beta;  //!< pi/(plate width)
 
-    double xi;   //!< X-position of point/partial load
-    double eta;  //!< Y-position of point/partial load
-    double c2;   //!< Partial load extension in X-direction
-    double d2;   //!< Partial load extension in Y-direction
-    char   type; //!< Load type parameter (0, 1, or 2)
-    int    mn;   //!< Number of terms in Fourier series in each direction
-    int    inc;  //!< Increment in Fourier term summation (1 or 2)
+    std::vector<double> fx; //!< Load factors in X-direction
+    std::vector<double> fy; //!< Load factors in Y-direction
+
+    char type; //!< Load type parameter (0, 1, or 2)
+    int  inc;  //!< Increment in Fourier term summation (1 or 2)
   };
 
 public:
   //! \brief Constructor for plate with constant pressure load.
   NavierPlate(double a, double b, double t, double E, double Poiss, double P,
-              int max_mn = 100);
+              int max_mn = 100, double eps = 1.0e-8);
   //! \brief Constructor for plate with partial pressure or point load.
   NavierPlate(double a, double b, double t, double E, double Poiss, double P,
               double xi_, double eta_, double c = 0.0, double d = 0.0,
-              int max_mn = 100);
+              int max_mn = 100, double eps = 1.0e-8);
   //! \brief Empty destructor.
   virtual ~NavierPlate() {}
 
@@ -260,11 +258,10 @@ protected:
   //! \brief Evaluates the solution/derivative at the point \a X.
   SymmTensor evaluate(const Vec3& X, int deriv) const;
 
-  //! \brief Adds the m'th and n'th terms of the plate solution to the moments.
-  void addTerms(std::vector<double>& M, double x, double y,
-                int m, int n, int deriv) const;
-
 private:
+  //! \brief Tabulates the load factors of the Fourier terms.
+  void initLoadFactors();
+
   double alpha; //!< pi/(plate length)
   double beta;  //!< pi/(plate width)
   double pz;    //!< Load parameter
@@ -276,6 +273,10 @@ private:
   double d2;   //!< Partial load extension in Y-direction
   int    mxmn; //!< Max number of terms in Fourier series in each direction
   int    inc;  //!< Increment in Fourier term summation (1 or 2)
+  double tol;  //!< Relative truncation tolerance of the Fourier series
+
+  std::vector<double> fx; //!< Load factors of the included terms along X
+  std::vector<double> fy; //!< Load factors of the included terms along Y
 };
 
 
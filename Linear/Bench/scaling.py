@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+#
+# Scaling benchmark driver for the linear elasticity and shell solvers.
+#
+# Runs a set of the regression models with uniform refinement levels and
+# thread counts, and writes per-phase times, peak RSS and DOFs/s to JSON.
+# The command-line options of each model are taken from the first line of
+# its .reg file, and the models are run in a temporary copy of their
+# test folder, such that the source tree is not modified.
+#
+# Example (from the build folder):
+#   python3 ../Bench/scaling.py --bindir bin --levels 0 1 2 \
+#           --threads 1 2 4 8 --json scaling.json
+
+import argparse
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+import xml.etree.ElementTree as ET
+
+SRCDIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+DEFAULT_MODELS = [
+    'Test/Bolt.reg',
+    'Test/ScordelisLo-p4-4x4.reg',
+    'Test/BeamFrame.reg',
+    'Test/CanTS2D-p2-dyn.reg',
+]
+
+# Keywords mapping the profiler task names onto the reported phases
+PHASES = [
+    ('preprocess', ('model input', 'initializ', 'preprocess')),
+    ('assembly', ('assembl',)),
+    ('solve', ('solv', 'eigen')),
+    ('projection', ('project', 'recover')),
+    ('norms', ('norm', 'error')),
+    ('output', ('output', 'vtf', 'hdf5', 'postprocess', 'result', 'dump')),
+]
+
+
+def read_reg(regfile):
+    """Returns the input file and options of a .reg file."""
+    with open(regfile) as f:
+        args = f.readline().split()
+    return args[0], args[1:]
+
+
+def param_dim(xinp, options):
+    """Returns the number of parametric directions of the model."""
+    for opt in options:
+        if opt.startswith('-1D'):
+            return 1
+        if opt.startswith('-2D'):
+            return 2
+    geo = ET.parse(xinp).getroot().find('.//geometry')
+    if geo is not None and geo.get('dim') in ('1', '2'):
+        return int(geo.get('dim'))
+    return 3
+
+
+def refine_model(xinp, outfile, level, ndim):
+    """Writes a copy of the model with every knot span split in 2^level."""
+    tree = ET.parse(xinp)
+    if level > 0:
+        nknot = str(2**level - 1)
+        for geo in tree.getroot().iter('geometry'):
+            ref = ET.SubElement(geo, 'refine', lowerpatch='1')
+            for d in 'uvw'[:ndim]:
+                ref.set(d, nknot)
+    tree.write(outfile)
+
+
+def parse_log(log):
+    """Extracts the number of DOFs and the profiler table from a run log."""
+    ndof = 0
+    for m in re.finditer(r'Number of dofs\s+(\d+)', log):
+        ndof = max(ndof, int(m.group(1)))
+
+    # The profiler table is printed last. Each task line holds the task name
+    # followed by its CPU and wall time, and possibly the number of calls.
+    profile = {}
+    start = log.rfind('Profil')
+    task = re.compile(r'^\s*([A-Za-z][\w ()/+-]*?)\s*:?\s+'
+                      r'(\d+\.\d*(?:[eE][-+]?\d+)?)'
+                      r'(?:\s+(\d+\.\d*(?:[eE][-+]?\d+)?))?')
+    for line in log[start:].splitlines() if start >= 0 else []:
+        m = task.match(line)
+        if m:
+            wall = m.group(3) if m.group(3) else m.group(2)
+            profile[m.group(1).strip()] = float(wall)
+
+    phases = dict.fromkeys([p for p, _ in PHASES], 0.0)
+    for name, wall in profile.items():
+        lname = name.lower()
+        for phase, keys in PHASES:
+            if any(k in lname for k in keys):
+                phases[phase] += wall
+                break
+    return ndof, profile, phases
+
+
+def run_model(app, workdir, xinp, options, threads):
+    """Runs one model and returns its log, wall time and peak RSS [kB]."""
+    env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    logname = os.path.join(workdir, 'run.log')
+    with open(logname, 'w') as log:
+        t0 = time.time()
+        proc = subprocess.Popen([app, xinp] + options, cwd=workdir, env=env,
+                                stdout=log, stderr=subprocess.STDOUT)
+        _, status, usage = os.wait4(proc.pid, 0)
+        wall = time.time() - t0
+    proc.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+    with open(logname) as log:
+        return log.read(), wall, usage.ru_maxrss, proc.returncode
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Scaling benchmark of the regression models')
+    parser.add_argument('--bindir', default='bin',
+                        help='folder with the LinEl and ShellEl executables')
+    parser.add_argument('--models', nargs='+', default=DEFAULT_MODELS,
+                        help='.reg files of the models, relative to '
+                             'the Linear folder or absolute')
+    parser.add_argument('--levels', nargs='+', type=int, default=[0, 1, 2],
+                        help='uniform refinement levels')
+    parser.add_argument('--threads', nargs='+', type=int, default=[1],
+                        help='thread counts')
+    parser.add_argument('--json', default='scaling.json',
+                        help='output file for the results')
+    args = parser.parse_args()
+
+    results = []
+    for model in args.models:
+        regfile = os.path.join(SRCDIR, model)
+        testdir = os.path.dirname(regfile)
+        isShell = os.path.basename(os.path.dirname(testdir)) == 'Shell'
+        app = os.path.abspath(os.path.join(args.bindir,
+                                           'ShellEl' if isShell else 'LinEl'))
+        xinp, options = read_reg(regfile)
+
+        workdir = tempfile.mkdtemp(prefix='scaling-')
+        try:
+            shutil.copytree(testdir, workdir, dirs_exist_ok=True)
+            ndim = param_dim(os.path.join(workdir, xinp), options)
+            for level in args.levels:
+                refined = 'scaling-r%d-%s' % (level, xinp)
+                refine_model(os.path.join(workdir, xinp),
+                             os.path.join(workdir, refined), level, ndim)
+                for nt in args.threads:
+                    log, wall, rss, status = run_model(app, workdir, refined,
+                                                       options, nt)
+                    ndof, profile, phases = parse_log(log)
+                    results.append({
+                        'model': os.path.basename(regfile)[:-4],
+                        'level': level, 'threads': nt, 'dofs': ndof,
+                        'status': status, 'wall': wall,
+                        'peak_rss_kb': rss,
+                        'dofs_per_s': ndof / wall if wall > 0.0 else 0.0,
+                        'phases': phases, 'profile': profile})
+                    print('%-24s level %d threads %3d: %9d DOFs %9.3f s '
+                          '%9d kB%s' % (results[-1]['model'], level, nt,
+                                        ndof, wall, rss,
+                                        '' if status == 0 else ' FAILED'))
+                    sys.stdout.flush()
+        finally:
+            shutil.rmtree(workdir)
+
+    with open(args.json, 'w') as f:
+        json.dump({'host': platform.node(), 'date': time.ctime(),
+                   'cpus': os.cpu_count(), 'runs': results}, f, indent=2)
+
+    return 0 if all(r['status'] == 0 for r in results) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,68 @@
+// $Id$
+//==============================================================================
+//!
+//! \file BlockCondensation.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Blocked static condensation of large linear equation systems.
+//!
+//==============================================================================
+
+#ifndef _BLOCK_CONDENSATION_H
+#define _BLOCK_CONDENSATION_H
+
+#include "MatVec.h"
+
+class SparseMatrix;
+
+
+/*!
+  \brief Class for blocked static condensation of a linear equation system.
+  \details The system matrix is split into an internal and a retained block.
+  The internal block is factorized only once, and the Schur complement is
+  then formed from multi-right-hand-side solves over panels of the retained
+  equations. Each solved panel is appended to the recovery matrix file as soon
+  as it has been used, such that the full recovery matrix never resides
+  in core. This makes it possible to condense models with thousands of
+  retained DOFs, where only the (dense) reduced matrix needs to fit in memory.
+
+  The recovery matrix file has the same text header as the files written by
+  AlgEqSystem::staticCondensation(), but is tagged with the word \a blocked.
+  Its columns are the internal solutions for unit displacements of each
+  unconstrained retained DOF, followed by the internal solution for the external load.
+  A signature file is written along with it, see RecoveryMatrix::Signature.
+  The internal displacements are recovered by RecoveryMatrix::recover().
+*/
+
+class BlockCondensation
+{
+public:
+  //! \brief The constructor initializes the panel size.
+  //! \param[in] panel Number of retained equations to solve for at once
+  explicit BlockCondensation(size_t panel) : nPanel(panel > 0 ? panel : 1) {}
+
+  //! \brief Performs the static condensation.
+  //! \param[in] K The assembled system matrix (in editable format)
+  //! \param[in] R The assembled right-hand-side vector
+  //! \param[in] extEqs Equation numbers of the retained DOFs,
+  //! non-positive for the constrained DOFs
+  //! \param[out] Kred Reduced system matrix
+  //! \param[out] Rred Associated reduced right-hand-side vector
+  //! \param[in] recFile Name of the recovery matrix file to write
+  bool condense(const SparseMatrix& K, const Vector& R, const IntVec& extEqs,
+                Matrix& Kred, Vector& Rred, const char* recFile) const;
+
+  //! \brief Checks if a recovery matrix file was written by this class.
+  //! \param[in] fileName Name of the recovery matrix file
+  static bool isBlocked(const char* fileName);
+
+  static size_t panelSize; //!< Panel size, zero for unblocked condensation
+
+private:
+  size_t nPanel; //!< Number of retained equations in each panel
+};
+
+#endif
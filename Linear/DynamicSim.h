@@ -15,15 +15,17 @@
 #define _DYNAMIC_SIM_H
 
 #include <ios>
+#include <vector>
 
 class SIMoutput;
 class DataExporter;
+struct Mode;
 
 
 /*!
   \brief Driver for modal simulation of linear dynamics problems.
   \param[in] infile The input file to parse for time integration setup
-  \param[in] nM Number of eigenmodes
+  \param[in] modes The eigenmodes of the problem
   \param[in] dumpModes If \e true, dump projected eigenmode solutions
   \param[in] qstatic If \e true, use quasi-static simulation mode
   \param model The isogeometric finite element model
@@ -33,7 +35,8 @@ class DataExporter;
   \return Exit status
 */
 
-int modalSim (char* infile, size_t nM, bool dumpModes, bool qstatic,
+int modalSim (char* infile, const std::vector<Mode>& modes,
+              bool dumpModes, bool qstatic,
               SIMoutput* model, DataExporter* exporter = nullptr,
               double zero_tol = 1.0e-8, std::streamsize outPrec = 6);
 
@@ -0,0 +1,87 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MatrixFreeOperator.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Matrix-free stiffness operator with a Jacobi-preconditioned CG.
+//!
+//==============================================================================
+
+#ifndef _MATRIX_FREE_OPERATOR_H
+#define _MATRIX_FREE_OPERATOR_H
+
+#include "GlobalIntegral.h"
+#include "MatVec.h"
+#include <functional>
+
+class SAM;
+
+
+/*!
+  \brief Global integral for matrix-free solution of linear static problems.
+  \details This class replaces the algebraic equation system during the
+  element assembly. It receives the element matrices and vectors, and
+  assembles only the diagonal of the element stiffness matrices and the
+  element vectors, both in equation ordering. The global stiffness matrix
+  is never formed.
+
+  The stiffness operator \b K*u is then evaluated by assembling the internal
+  forces of the given displacement field (mode SIM::INT_FORCES), which the
+  integrand computes as -B^T*sigma in each integration point. The diagonal is
+  used as a Jacobi preconditioner in the conjugate gradient solver pcg().
+
+  The element assembly is done by the multi-threaded element loop of the
+  patches, where the elements of a thread group have no common nodes.
+  The assemble() method may therefore be invoked concurrently.
+
+  \note Multi-point constraints are not accounted for, only homogeneous and
+  inhomogeneous Dirichlet conditions on single DOFs.
+*/
+
+class MatrixFreeOperator : public GlobalIntegral
+{
+public:
+  //! \brief The constructor initializes the vectors to zero.
+  //! \param[in] sam Assembly management data of the model
+  explicit MatrixFreeOperator(const SAM& sam);
+  //! \brief Empty destructor.
+  virtual ~MatrixFreeOperator() {}
+
+  //! \brief Initializes the assembled vectors to zero.
+  //! \param[in] newLHS If \e true, the diagonal is also initialized
+  virtual void initialize(char newLHS);
+  //! \brief Adds an element matrix diagonal and vector into the global ones.
+  //! \param[in] elmObj Pointer to the element matrices and vectors
+  //! \param[in] elmId Global number of the element associated with \a elmObj
+  virtual bool assemble(const LocalIntegral* elmObj, int elmId);
+
+  //! \brief Returns the assembled diagonal of the stiffness matrix.
+  const Vector& getDiagonal() const { return diag; }
+  //! \brief Returns the assembled element vectors.
+  const Vector& getVector() const { return vec; }
+
+  //! \brief Function type evaluating \b y = \b K*x.
+  typedef std::function<bool(const Vector& x, Vector& y)> Operator;
+
+  //! \brief Solves \b K*x = \b b by the Jacobi-preconditioned CG method.
+  //! \param[in] apply Function evaluating the stiffness operator
+  //! \param[in] b The right-hand-side vector
+  //! \param[in,out] x Initial guess on input, the solution on output
+  //! \param[in] tol Convergence tolerance on the relative residual norm
+  //! \param[in] maxIt Maximum number of iterations
+  //! \return Number of iterations performed, negative on failure
+  int pcg(const Operator& apply, const Vector& b, Vector& x,
+          double tol, int maxIt) const;
+
+private:
+  const SAM& mySam; //!< Assembly management data
+
+  Vector diag; //!< Diagonal of the stiffness matrix
+  Vector vec;  //!< Assembled element vectors
+};
+
+#endif
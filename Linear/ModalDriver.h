@@ -17,9 +17,16 @@
 #include "NewmarkDriver.h"
 #include "NewmarkSIM.h"
 
+struct Mode;
+
 
 /*!
   \brief Driver for modal analysis of linear dynamic problems.
+  \details If the attribute \a diagonal is set in the \a newmarksolver tag,
+  the modal equations are integrated directly by this class, one mode at a
+  time, without assembling and solving a modal equation system. This assumes
+  mass-normalized eigenmodes, such that the modal equations are uncoupled.
+  The physical solution is then expanded only when it is needed for output.
 */
 
 class ModalDriver : public NewmarkDriver<NewmarkSIM>
@@ -27,7 +34,8 @@ class ModalDriver : public NewmarkDriver<NewmarkSIM>
 public:
   //! \brief The constructor forwards to the parent class constructor.
   explicit ModalDriver(SIMbase& sim, bool qs = false)
-    : NewmarkDriver<NewmarkSIM>(sim) { qstatic = qs; }
+    : NewmarkDriver<NewmarkSIM>(sim), myModes(nullptr), lastDt(0.0)
+  { qstatic = qs; diagonal = expanded = false; }
 
   //! \brief Empty destructor.
   virtual ~ModalDriver() {}
@@ -58,8 +66,38 @@ public:
   //! \brief Updates configuration variables (solution vector) in an iteration.
   virtual bool correctStep(TimeStep& tp, bool);
 
+  //! \brief Parses a data section from an XML document.
+  virtual bool parse(const tinyxml2::XMLElement* elem);
+
+  //! \brief Defines the eigenmodes, as needed by the diagonal integrator.
+  void setModes(const std::vector<Mode>& modes) { myModes = &modes; }
+
+  using NewmarkDriver<NewmarkSIM>::solveStep;
+  //! \brief Solves the dynamic problem at the current time step.
+  //! \param tp Time stepping parameters
+  //! \param[in] mode Solution mode to use for this step
+  //! \param[in] zero_tolerance Truncate norm values smaller than this to zero
+  //! \param[in] outPrec Number of digits after the decimal point in norm print
+  virtual SIM::ConvStatus solveStep(TimeStep& tp,
+                                    SIM::SolutionMode mode = SIM::DYNAMIC,
+                                    double zero_tolerance = 1.0e-8,
+                                    std::streamsize outPrec = 0);
+
 private:
-  bool qstatic; //!< If \e true, use quasi-static simulation driver
+  //! \brief Advances all modal coordinates one step by the Newmark formulas.
+  SIM::ConvStatus solveDiagonal(TimeStep& tp);
+
+  bool qstatic;  //!< If \e true, use quasi-static simulation driver
+  bool diagonal; //!< If \e true, use the diagonal modal integrator
+
+  mutable bool expanded; //!< If \e true, the physical solution is up to date
+
+  const std::vector<Mode>* myModes; //!< The eigenmodes of the problem
+
+  RealArray omega2; //!< Squared angular eigenfrequencies
+  RealArray damp;   //!< Modal damping coefficients
+  RealArray invDen; //!< Inverse Newmark denominators for current time step
+  double    lastDt; //!< Time step size used for \ref invDen
 };
 
 #endif
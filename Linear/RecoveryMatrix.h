@@ -0,0 +1,139 @@
+// $Id$
+//==============================================================================
+//!
+//! \file RecoveryMatrix.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Access to static condensation recovery matrix files.
+//!
+//==============================================================================
+
+#ifndef _RECOVERY_MATRIX_H
+#define _RECOVERY_MATRIX_H
+
+#include "MatVec.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+
+namespace RecoveryMatrix //! Utilities for static condensation recovery matrices
+{
+  /*!
+    \brief Signature of a recovery matrix file.
+    \details The signature is stored in a separate text file, with the name
+    of the recovery matrix file appended by \a .sig. It identifies the model
+    the recovery matrix was computed for, and contains a checksum of the
+    matrix coefficients, such that a stale or mismatching recovery matrix
+    file is detected when it is read.
+  */
+  struct Signature
+  {
+    size_t   rows = 0;     //!< Number of matrix rows
+    size_t   cols = 0;     //!< Number of matrix columns
+    size_t   neq = 0;      //!< Number of equations of the condensed model
+    IntVec   retained;     //!< Equation numbers of the retained DOFs
+    uint64_t checksum = 0; //!< Checksum of the matrix coefficients
+
+    //! \brief Updates the checksum with some matrix coefficients.
+    //! \param[in] data The matrix coefficients, in file order
+    //! \param[in] n Number of coefficients
+    void addToChecksum(const Real* data, size_t n);
+
+  private:
+    uint64_t sum[2] = { 0, 0 }; //!< Running sums of the checksum
+  };
+
+  /*!
+    \brief Class for column-wise access to a recovery matrix file.
+    \details The file is accessed through a read-only shared memory mapping,
+    when supported by the platform. The pages of the file are then shared by
+    all processes reading the same file. The file format is the one written
+    by AlgEqSystem::staticCondensation(), that is a one-line text header
+    with the matrix dimensions followed by the binary matrix coefficients
+    in column-major order. The internal solution is then {Ui} = [R]{Ue;1}.
+    The blocked files written by BlockCondensation have the same layout,
+    but the internal solution is {Ui} = {Xr} - [X]{Ue} in that format.
+  */
+  class File
+  {
+  public:
+    //! \brief The constructor opens and maps the given file.
+    explicit File(const char* fileName);
+    //! \brief The destructor unmaps and closes the file.
+    ~File();
+
+    //! \brief Parses the file header and checks it against the signature.
+    //! \param[in] neq Expected number of equations, 0 means unchecked
+    //! \param[in] retained Expected retained equations, empty means unchecked
+    //! \return \e false if the file is invalid or does not match
+    bool open(size_t neq = 0, const IntVec& retained = IntVec());
+
+    //! \brief Returns the number of matrix rows.
+    size_t rows() const { return sig.rows; }
+    //! \brief Returns the number of matrix columns.
+    size_t cols() const { return sig.cols; }
+    //! \brief Returns \e true if the file has a signature.
+    bool hasSignature() const { return haveSig; }
+    //! \brief Returns \e true if the file was written by BlockCondensation.
+    bool isBlocked() const { return blocked; }
+
+    //! \brief Copies a range of matrix columns from the file.
+    //! \param[in] c 0-based index of the first column to copy
+    //! \param[in] nc Number of columns to copy
+    //! \param[out] X Array of size rows()*nc to receive the coefficients
+    bool getColumns(size_t c, size_t nc, Real* X);
+
+    //! \brief Checks the checksum of the matrix coefficients.
+    //! \details All columns must have been copied, in sequential order,
+    //! through getColumns() before this method is invoked.
+    bool verify() const;
+
+  private:
+    std::string fname; //!< Name of the recovery matrix file
+
+    Signature sig;     //!< Signature of the file
+    Signature calc;    //!< Checksum of the coefficients copied so far
+    bool      haveSig; //!< If \e true, the file has a signature
+    bool      blocked; //!< If \e true, the file is in blocked format
+    size_t    nextCol; //!< Index of the next column in sequential order
+
+    const char* map;    //!< Mapped file content
+    size_t      fsize;  //!< Size of the file
+    size_t      offset; //!< Byte offset of the first matrix coefficient
+    FILE*       fd;     //!< File handle, if the file can not be mapped
+  };
+
+  //! \brief Writes the signature of a recovery matrix file.
+  //! \param[in] fileName Name of the recovery matrix file
+  //! \param[in] sig The signature to write
+  bool writeSignature(const char* fileName, const Signature& sig);
+
+  //! \brief Computes and writes the signature of a recovery matrix file.
+  //! \param[in] fileName Name of the recovery matrix file
+  //! \param[in] neq Number of equations of the condensed model
+  //! \param[in] retained Equation numbers of the retained DOFs
+  bool sign(const char* fileName, size_t neq, const IntVec& retained);
+
+  //! \brief Recovers the internal DOFs from the retained DOF values.
+  //! \param[in] fileName Name of the recovery matrix file
+  //! \param[in] neq Number of equations of the condensed model
+  //! \param[in] extEqs Equation numbers of the retained DOFs,
+  //! non-positive for the constrained DOFs
+  //! \param[in] Sdisp Displacements at the retained DOFs
+  //! \param[out] eqSol Displacement vector for all equations of the model
+  //!
+  //! \details The recovery matrix is read from the file in panels of about
+  //! 1 MB each, such that it never resides in core. Both the files written by
+  //! AlgEqSystem::staticCondensation() and by BlockCondensation are accepted.
+  //! The file is rejected if it does not match its signature, or if the
+  //! signature does not match the given model. Files without a signature
+  //! are accepted with a warning.
+  bool recover(const char* fileName, size_t neq, const IntVec& extEqs,
+               const Vector& Sdisp, Vector& eqSol);
+}
+
+#endif
@@ -17,9 +17,15 @@
 #include "SIMElasticity.h"
 #include "ElasticityUtils.h"
 #include "LinearElasticity.h"
+#include "RecoveryMatrix.h"
+#include "BlockCondensation.h"
+#include "MatrixFreeOperator.h"
 #include "AlgEqSystem.h"
+#include "SparseMatrix.h"
+#include "SAM.h"
 #include "AnaSol.h"
 #include "ASMbase.h"
+#include "MPC.h"
 #include "IFEM.h"
 #include "SIM2D.h"
 #include "SIM3D.h"
@@ -115,6 +121,145 @@ public:
     return ok;
   }
 
+  //! \brief Checks whether the model can be solved matrix-free.
+  //! \details The element loops of the matrix-free solver only account for
+  //! the free and prescribed DOFs. Multi-point constraints with master DOFs
+  //! would require the constraint equations to be eliminated from both the
+  //! element operator and the preconditioner, so such models are solved
+  //! with the assembled equation system instead.
+  bool canSolveMatrixFree() const
+  {
+    for (const ASMbase* pch : Dim::myModel)
+      for (MPCIter cit = pch->begin_MPC(); cit != pch->end_MPC(); ++cit)
+        if ((*cit)->getNoMaster() > 0)
+          return false;
+
+    return true;
+  }
+
+  //! \brief Solves the linear static problem without a global matrix.
+  //! \param[out] solution Global primary solution vector
+  //! \param[in] time Parameters for time-dependent load functions
+  //! \param[in] tol Relative residual tolerance of the CG iterations
+  //! \param[in] maxIt Max number of CG iterations, 0 means number of equations
+  //!
+  //! \details The diagonal of the stiffness matrix and the load vector are
+  //! first assembled in one element loop, without allocating the global
+  //! stiffness matrix. The equation system is then solved by the
+  //! Jacobi-preconditioned conjugate gradient method, where each iteration
+  //! evaluates the stiffness operator by one element loop computing the
+  //! internal forces, see MatrixFreeOperator.
+  bool solveMatrixFree(Vector& solution, const TimeDomain& time,
+                       double tol, int maxIt = 0)
+  {
+    LinearElasticity* elp = dynamic_cast<LinearElasticity*>(Dim::myProblem);
+    if (!elp)
+    {
+      std::cerr <<" *** SIMLinEl::solveMatrixFree: No integrand."<< std::endl;
+      return false;
+    }
+    else if (!this->canSolveMatrixFree())
+    {
+      std::cerr <<" *** SIMLinEl::solveMatrixFree: The model has multi-point"
+                <<" constraints, use the assembled equation system."
+                << std::endl;
+      return false;
+    }
+
+    // The equation system holds the nodal point loads only
+    if (!this->initSystem(Dim::opt.solver,0,1))
+      return false;
+
+    MatrixFreeOperator op(*Dim::mySam);
+    elp->setOperatorInt(&op);
+
+    // Lambda function evaluating the internal forces, y = -K*x,
+    // where x is in equation ordering and scaleSD is the scaling factor
+    // of the prescribed DOFs (0.0 for homogeneous Dirichlet conditions).
+    Vectors u(1);
+    auto&& intForces = [this,&op,&time,&u](const Vector& x, double scaleSD)
+    {
+      if (!Dim::mySam->expandSolution(StdVector(x),u.front(),scaleSD))
+        return false;
+
+      op.initialize(false);
+      return this->assembleSystem(time,u,false);
+    };
+
+    // Assemble the stiffness diagonal and the external load vector
+    this->setMode(SIM::STATIC);
+    this->setQuadratureRule(Dim::opt.nGauss[0],true,true);
+    op.initialize(true);
+    bool ok = this->assembleSystem(time,Vectors());
+    Vector b(op.getVector());
+    const StdVector* R = dynamic_cast<const StdVector*>
+      (Dim::myEqSys->getVector());
+    if (R && R->size() == b.size())
+      b.add(*R);
+
+    // Account for inhomogeneous Dirichlet conditions, b -= K*u_D
+    Vector x(b.size());
+    this->setMode(SIM::INT_FORCES);
+    if (ok && Dim::mySam->expandSolution(StdVector(x),u.front()))
+      if (u.front().normInf() > 0.0 && (ok = intForces(x,1.0)))
+        b.add(op.getVector());
+
+    // Lambda function evaluating the stiffness operator, y = K*x.
+    auto&& apply = [&op,&intForces](const Vector& x, Vector& y)
+    {
+      if (!intForces(x,0.0))
+        return false;
+
+      y = op.getVector();
+      y *= -1.0;
+      return true;
+    };
+
+    IFEM::cout <<"\nSolving "<< b.size() <<" equations matrix-free"
+               <<" with Jacobi-preconditioned CG"<< std::endl;
+    if (ok && op.pcg(apply,b,x,tol,maxIt > 0 ? maxIt : b.size()) >= 0)
+      ok = Dim::mySam->expandSolution(StdVector(x),solution);
+    else
+      ok = false;
+
+    elp->setOperatorInt(nullptr);
+    return ok;
+  }
+
+  //! \brief Assigns a new value to a material parameter of the model.
+  //! \param[in] name Name of the material parameter, e.g., \a "E"
+  //! \param[in] value The new parameter value
+  //! \param[in] imat 1-based material index, 0 means all materials
+  //!
+  //! \details The buffered element matrices of the integrand are discarded,
+  //! such that the next assembly accounts for the new material properties.
+  //! The sparsity pattern of the equation system is not affected.
+  bool setMaterialParameter(const char* name, double value, size_t imat = 0)
+  {
+    if (imat > this->mVec.size())
+    {
+      std::cerr <<" *** SIMLinEl::setMaterialParameter: Material index "
+                << imat <<" out of range [1,"<< this->mVec.size() <<"]."
+                << std::endl;
+      return false;
+    }
+
+    bool ok = !this->mVec.empty();
+    for (size_t i = 0; i < this->mVec.size(); i++)
+      if (imat == 0 || i+1 == imat)
+        ok &= this->mVec[i]->setParameter(name,value);
+
+    if (!ok)
+      std::cerr <<" *** SIMLinEl::setMaterialParameter: Can not assign \""
+                << name <<"\" = "<< value <<" to the material model."
+                << std::endl;
+
+    LinearElasticity* elp = dynamic_cast<LinearElasticity*>(Dim::myProblem);
+    if (elp) elp->clearElmBuffers();
+
+    return ok;
+  }
+
   //! \brief Returns current reaction force vector.
   virtual const Vector* getReactionForces() const
   {
@@ -124,6 +269,11 @@ public:
   //! \brief Performs static condensation of the linear equation system.
   //! \param[out] Kred Reduced System matrix
   //! \param[out] Rred Associated reduced right-hand-side vector
+  //!
+  //! \details If BlockCondensation::panelSize is positive, the condensation
+  //! is performed in panels of that many retained equations, see the
+  //! BlockCondensation class. Otherwise, the condensation is performed by the
+  //! equation system in one go.
   virtual bool staticCondensation(Matrix& Kred, Vector& Rred)
   {
     // Assemble [K] and {R}
@@ -134,19 +284,58 @@ public:
     if (!this->assembleSystem())
       return false;
 
-    return Dim::myEqSys->staticCondensation(Kred,Rred,myRetainNodes,
-                                            0,recFile.c_str());
+    IntVec extEqs;
+    if (!this->getRetainedEqns(extEqs))
+    {
+      std::cerr <<" *** SIMLinEl::staticCondensation: Invalid retained nodes."
+                << std::endl;
+      return false;
+    }
+
+    if (BlockCondensation::panelSize > 0)
+    {
+      const SparseMatrix* K = dynamic_cast<const SparseMatrix*>
+        (Dim::myEqSys->getMatrix());
+      const StdVector* R = dynamic_cast<const StdVector*>
+        (Dim::myEqSys->getVector());
+      if (!K || !R)
+      {
+        std::cerr <<" *** SIMLinEl::staticCondensation: No sparse equation"
+                  <<" system."<< std::endl;
+        return false;
+      }
+
+      BlockCondensation condenser(BlockCondensation::panelSize);
+      return condenser.condense(*K,*R,extEqs,Kred,Rred,recFile.c_str());
+    }
+
+    // Sign the recovery matrix file, such that it is validated when read
+    return (Dim::myEqSys->staticCondensation(Kred,Rred,myRetainNodes,
+                                             0,recFile.c_str()) &&
+            RecoveryMatrix::sign(recFile.c_str(),
+                                 Dim::getNoEquations(),extEqs));
   }
 
   //! \brief Recovers internal displacements from supernode displacements.
   //! \param[in] Sdisp Local displacements at the supernodes
   //! \param[out] fullDisp Local displacement vector for the entire FE model
+  //!
+  //! \details The recovery matrix is read panel by panel from the file in
+  //! each recovery, and never resides in core, see RecoveryMatrix::recover().
+  //! This method may therefore be invoked concurrently for several instances
+  //! of the same superelement. The recovery matrix file is rejected if it was
+  //! not computed for the equations and retained DOFs of this model.
   virtual bool recoverInternals(const Vector& Sdisp, Vector& fullDisp)
   {
-    if (Rmat.empty() && !AlgEqSystem::readRecoveryMatrix(Rmat,recFile.c_str()))
+    IntVec extEqs;
+    Vector eqSol;
+    if (!this->getRetainedEqns(extEqs) ||
+        !RecoveryMatrix::recover(recFile.c_str(),Dim::getNoEquations(),
+                                 extEqs,Sdisp,eqSol))
       return false;
 
-    return Dim::myEqSys->recoverInternals(Rmat,myRetainNodes,Sdisp,fullDisp);
+    // Expand to DOF order, including the prescribed Dirichlet values
+    return Dim::mySam->expandSolution(StdVector(eqSol),fullDisp);
   }
 
   //! \brief Returns the superelement file name, if any.
@@ -359,6 +548,22 @@ protected:
     return true;
   }
 
+  //! \brief Returns the equation numbers of the retained nodes.
+  //! \details The equation numbers are in the supernode DOF layout, that is
+  //! all DOFs of each retained node. Constrained DOFs are kept as
+  //! placeholders with a non-positive equation number.
+  bool getRetainedEqns(IntVec& extEqs) const
+  {
+    IntVec mnen;
+    for (int inod : myRetainNodes)
+      if (!Dim::mySam->getNodeEqns(mnen,inod))
+        return false;
+      else
+        extEqs.insert(extEqs.end(),mnen.begin(),mnen.end());
+
+    return !extEqs.empty();
+  }
+
 public:
   //! \brief Returns whether a dual solution is available or not.
   virtual bool haveDualSol() const { return dualS == 'd' && Dim::dualField; }
@@ -379,8 +584,6 @@ private:
   std::string supSC;     //!< Superelement subjected to static condensation
   std::string supelName; //!< Name of superelement file
   std::string recFile;   //!< Name of displacement recovery file
-
-  Matrix Rmat; //!< Static condensation recovery matrix
 };
 
 typedef SIMLinEl<SIM2D> SIMLinEl2D; //!< 2D specific driver
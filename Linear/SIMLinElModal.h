@@ -32,7 +32,7 @@ public:
   //! \param[in] modes Array of eigenmodes for the elasticity problem
   //! \param[in] checkRHS If \e true, ensure the model is in a right-hand system
   explicit SIMLinElModal(std::vector<Mode>& modes, bool checkRHS = false)
-    : SIMLinEl<Dim>(nullptr,checkRHS,'m'), SIMmodal(modes) {}
+    : SIMLinEl<Dim>(nullptr,checkRHS,'m'), SIMmodal(modes), batchProj(false) {}
   //! \brief Empty destructor.
   virtual ~SIMLinElModal() {}
 
@@ -112,6 +112,10 @@ public:
   //! \param[out] sesol Control point values of the secondary eigen solutions
   //! \param[out] names Secondary solution component names
   //! \param[in] pMethod Projection method to use
+  //!
+  //! \details All eigenmodes are projected in a single pass, such that the
+  //! element loop and the projection equation system are shared by all modes.
+  //! If that fails, the modes are projected one by one instead.
   virtual bool projectModes(Matrices& sesol,
                             std::vector<std::string>& names,
                             SIMoptions::ProjectionMethod pMethod)
@@ -121,7 +125,39 @@ public:
     for (size_t c = 0; c < names.size(); c++)
       names[c] = Dim::myProblem->getField2Name(c);
 
-    bool ok = this->setMode(SIM::RECOVERY);
+    if (!this->setMode(SIM::RECOVERY))
+      return false;
+
+    Elasticity* elp = dynamic_cast<Elasticity*>(Dim::myProblem);
+    if (elp && myModes.size() > 1)
+    {
+      // The secondary solution of mode 1 is stored in the first nf rows of
+      // the projected batch solution, followed by those of mode 2, etc.
+      Matrix batch;
+      elp->setSolutionBatch(myModes.size());
+      batchProj = true;
+      bool ok = this->project(batch,myModes.front().eigVec,pMethod);
+      batchProj = false;
+      elp->setSolutionBatch(0);
+
+      const size_t nf = names.size();
+      if (ok && batch.rows() == nf*myModes.size())
+      {
+        for (size_t i = 0; i < myModes.size(); i++)
+        {
+          sesol[i].resize(nf,batch.cols());
+          for (size_t n = 1; n <= batch.cols(); n++)
+            for (size_t c = 1; c <= nf; c++)
+              sesol[i](c,n) = batch(i*nf+c,n);
+        }
+        return true;
+      }
+
+      IFEM::cout <<"  ** Batched projection of the eigenmodes failed,"
+                 <<" projecting them one by one."<< std::endl;
+    }
+
+    bool ok = true;
     for (size_t i = 0; i < myModes.size() && ok; i++)
       ok = this->project(sesol[i],myModes[i].eigVec,pMethod);
 
@@ -150,6 +186,26 @@ protected:
     this->setIntegrationPrm(1,alpha2);
     return this->SIMLinEl<Dim>::preprocessB();
   }
+
+  //! \brief Initializes material properties for the given patch.
+  //! \param[in] patch 1-based patch index
+  //!
+  //! \details During batched projection of the eigenmodes, this method also
+  //! extracts the patch-level vectors of all modes, except the first mode
+  //! which is extracted by the projection method itself.
+  virtual bool setPatchMaterial(size_t patch)
+  {
+    if (batchProj && patch > 0 && patch <= Dim::myModel.size())
+      for (size_t i = 1; i < myModes.size(); i++)
+        Dim::myModel[patch-1]->extractNodalVec(myModes[i].eigVec,
+                                               Dim::myProblem->getSolution(i),
+                                               Dim::mySam->getMADOF());
+
+    return this->SIMLinEl<Dim>::setPatchMaterial(patch);
+  }
+
+private:
+  bool batchProj; //!< If \e true, a batched mode projection is in progress
 };
 
 #endif
@@ -15,6 +15,8 @@
 #define _LINEAR_ELASTICITY_H
 
 #include "Elasticity.h"
+#include "ElmMatrixCache.h"
+#include "ResultPointCache.h"
 
 class RealFunc;
 
@@ -36,8 +38,8 @@ public:
   //! \param[in] modal If \e true, a modal dynamics simulation is performed
   explicit LinearElasticity(unsigned short int n, bool axSym = false,
                             bool GPout = false, bool modal = false);
-  //! \brief Empty destructor.
-  virtual ~LinearElasticity() {}
+  //! \brief The destructor prints out the element matrix buffer statistics.
+  virtual ~LinearElasticity();
 
   //! \brief Parses a data section from an XML element.
   virtual bool parse(const tinyxml2::XMLElement* elem);
@@ -53,12 +55,56 @@ public:
   //! If equal to 0, reuse buffered element matrices.
   virtual void initLHSbuffers(size_t nEl);
 
+  //! \brief Defines a global integral replacing the equation system.
+  //! \param[in] gq The global integral to use (not owned by this object)
+  //! \details This is used by the matrix-free solver, and the element
+  //! quantities are then assembled into \a gq instead, if not null.
+  void setOperatorInt(GlobalIntegral* gq) { myOperI = gq; }
+  //! \brief Returns the system quantity to be integrated by \a *this.
+  virtual GlobalIntegral& getGlobalInt(GlobalIntegral* gq) const;
+
+  //! \brief Enables or disables the reuse of FE stresses between passes.
+  //! \param[in] on If \e true, the FE stresses at each evaluation point are
+  //! cached, and reused when the same point is evaluated in a later pass.
+  //! If \e false, the cache is not used, but its contents are kept.
+  //! \param[in] mBytes Memory budget of the cache in MBytes (0 is unlimited)
+  //! \param[in] nel Number of elements in the model, to pre-size the cache
+  //!
+  //! \details This is used to let the projections and norm integrations of
+  //! the post-processing share the FE stress evaluations. The caller has to
+  //! disable the cache while other solutions than the cached one are
+  //! evaluated, and clear it with clearStresses() when the solution changes.
+  void reuseStresses(bool on, double mBytes = 0.0, size_t nel = 0);
+  //! \brief Clears the cached FE stresses.
+  void clearStresses() { mySigma.clear(); }
+
+  //! \brief Returns \e true if element equivalence detection is requested.
+  bool useElmClasses() const { return useClasses; }
+  //! \brief Defines the equivalence classes of the elements.
+  //! \param[in] classes 0-based class index of each element (-1 if unique)
+  //! \param[in] nClass Number of equivalence classes
+  //!
+  //! \details The material stiffness matrix is then only integrated for the
+  //! first element of each class. The other elements of the class are assigned
+  //! a copy of this matrix, as long as the stiffness does not change.
+  void setElmClasses(const std::vector<int>& classes, size_t nClass);
+
+  //! \brief Discards all buffered element matrices and result operators.
+  //! \details This has to be invoked when the material properties change,
+  //! such that the element matrices are recomputed in the next assembly.
+  void clearElmBuffers();
+
   using Elasticity::initIntegration;
   //! \brief Initializes the integrand with the number of integration points.
   //! \param[in] nGp Total number of interior integration points
   //! \param[in] nBp Total number of boundary integration points
   virtual void initIntegration(size_t nGp, size_t nBp);
 
+  //! \brief Initializes the integrand for a new result point loop.
+  //! \param[in] lambda Load parameter
+  //! \param[in] prinDirs If \e true, compute/store principal directions
+  virtual void initResultPoints(double lambda, bool prinDirs);
+
   using Elasticity::initElement;
   //! \brief Initializes current element for numerical integration.
   //! \param[in] MNPC Matrix of nodal point correspondance for current element
@@ -94,6 +140,24 @@ public:
   virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
                        const Vec3& X, const Vec3& normal) const;
 
+  using Elasticity::evalSol;
+  //! \brief Evaluates the finite element (FE) solution at an integration point.
+  //! \param[out] s The FE stress values at current point
+  //! \param[in] eV Element solution vectors
+  //! \param[in] fe Finite element data at current point
+  //! \param[in] X Cartesian coordinates of current point
+  //! \param[in] toLocal If \e true, transform to local coordinates (if defined)
+  //! \param[out] pdir Directions of the principal stresses (optional)
+  //!
+  //! \details In a result point loop, and if enabled by the \<resultcache\>
+  //! tag, the stresses are evaluated from a cached linear operator of each
+  //! point, established the first time the point is evaluated.
+  //! If enabled by reuseStresses(), the stresses of points that were
+  //! evaluated in a previous pass are reused instead.
+  virtual bool evalSol(Vector& s, const Vectors& eV, const FiniteElement& fe,
+                       const Vec3& X, bool toLocal = false,
+                       Vec3* pdir = nullptr) const;
+
   using Elasticity::finalizeElement;
   //! \brief Finalizes the element matrices after the numerical integration.
   //! \param elmInt The local integral object to receive the contributions
@@ -101,7 +165,7 @@ public:
   //! \param[in] time Parameters for nonlinear and time-dependent simulations
   //!
   //! \details This method is used to updates the element matrix buffers
-  //! \ref myKmats and \ref myMmats, in case initLHSbuffers() has been invoked
+  //! \ref myKbuf and \ref myMbuf, in case initLHSbuffers() has been invoked
   //! with \a nEl > 1 as argument.
   virtual bool finalizeElement(LocalIntegral& elmInt, const FiniteElement& fe,
                                const TimeDomain& time, size_t);
@@ -136,9 +200,21 @@ protected:
 
 private:
   mutable Vec3Vec* myItgPts; //!< Global Gauss point coordinates
+  GlobalIntegral*  myOperI;  //!< Matrix-free operator integral
+
+  ElmMatrixCache myKbuf; //!< Element stiffness matrix buffer
+  ElmMatrixCache myMbuf; //!< Element mass matrix buffer
+  bool         reuseLHS; //!< If \e true, reuse the buffered element matrices
+
+  std::vector<int>  myElmClass; //!< Equivalence class index of each element
+  std::vector<char> myKshared;  //!< Flags elements with a shared stiffness
+  ElmMatrixCache    myCbuf;     //!< Stiffness matrix of each element class
+  bool              useClasses; //!< Element equivalence detection flag
 
-  Matrices myKmats; //!< Element stiffness matrix buffer
-  Matrices myMmats; //!< Element mass matrix buffer
+  mutable ResultPointCache myPcache; //!< Result point operator cache
+  mutable ResultPointCache mySigma;  //!< FE stresses of previous passes
+  bool useSigma; //!< If \e true, reuse the FE stresses of previous passes
+  bool inResultPts; //!< If \e true, a result point loop is active
 
   bool isModal; //!< Flag for modal dynamics simulation
 };
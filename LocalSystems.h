@@ -0,0 +1,47 @@
+// $Id$
+//==============================================================================
+//!
+//! \file LocalSystems.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Local coordinate systems for linear elasticity problems.
+//!
+//==============================================================================
+
+#ifndef _LOCAL_SYSTEMS_H
+#define _LOCAL_SYSTEMS_H
+
+#include "Tensor.h"
+
+
+/*!
+  \brief Base class for reentrant local coordinate systems.
+  \details The sub-classes compute the global-to-local transformation into
+  a tensor owned by the caller, such that they can be used concurrently
+  from several threads. The inherited single-argument getTmat() method
+  returns a reference to a thread-local tensor instead.
+*/
+
+class ElasticLocalSystem : public LocalSystem
+{
+protected:
+  //! \brief The default constructor is protected to allow sub-classes only.
+  ElasticLocalSystem() {}
+
+public:
+  //! \brief Empty destructor.
+  virtual ~ElasticLocalSystem() {}
+
+  //! \brief Computes the global-to-local transformation at the point \a X.
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[out] T The 3D transformation tensor
+  virtual void getTmat(const Vec3& X, Tensor& T) const = 0;
+  //! \brief Computes the global-to-local transformation at the point \a X.
+  //! \return Reference to a thread-local transformation tensor
+  virtual const Tensor& getTmat(const Vec3& X) const;
+};
+
+#endif
@@ -47,6 +47,8 @@ public:
 
   //! \brief Returns \e false if plane stress in 2D.
   virtual bool isPlaneStrain() const { return true; }
+  //! \brief Returns \e true if the stiffness is constant in space.
+  virtual bool isHomogeneous() const { return false; }
 
   //! \brief Initializes the material with the number of integration points.
   virtual void initIntegration(size_t) {}
@@ -58,6 +60,9 @@ public:
   virtual void addSpecialPoint(const Vec3&) {}
   //! \brief Assigns a scalar field defining the material properties.
   virtual void assignScalarField(Field*, size_t = 0) {}
+  //! \brief Assigns a new value to a named material parameter.
+  //! \return \e false if the parameter is not known by this material model
+  virtual bool setParameter(const char*, double) { return false; }
 
   //! \brief Evaluates the stiffness at current point.
   virtual double getStiffness(const Vec3&) const { return 1.0; }
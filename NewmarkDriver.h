@@ -19,11 +19,14 @@
 #include "SIMenums.h"
 #include "DataExporter.h"
 #include "HDF5Restart.h"
+#include "AsyncOutput.h"
 #include "TimeStep.h"
 #include "Utilities.h"
 #include "Profiler.h"
 #include "tinyxml2.h"
 #include <fstream>
+#include <sstream>
+#include <memory>
 
 
 /*!
@@ -105,6 +108,10 @@ public:
     utl::LogStream* log = os ? new utl::LogStream(*os) : &IFEM::cout;
     std::streamsize rptPrec = outPrec > 0 ? outPrec : 3;
 
+    // Background thread for the pure file output tasks. In parallel runs,
+    // the tasks are executed on the main thread (see AsyncOutput).
+    AsyncOutput output(2,!Newmark::model.getProcessAdm().isParallel());
+
     // Invoke the time-step loop
     int status = 0;
     for (int iStep = 0; status == 0 && this->advanceStep(params);)
@@ -128,7 +135,17 @@ public:
       utl::profiler->start("Postprocessing");
 
       // Print solution components at the user-defined points
-      this->dumpResults(params.time.t,*log,rptPrec,!os);
+      if (os)
+      {
+        // Format the results now, but write them to file on the I/O thread
+        std::shared_ptr<std::ostringstream> buf(new std::ostringstream());
+        utl::LogStream bufLog(*buf);
+        this->dumpResults(params.time.t,bufLog,rptPrec,false);
+        if (!output.push([log,buf]() { *log << buf->str(); return true; }))
+          status += 18;
+      }
+      else
+        this->dumpResults(params.time.t,*log,rptPrec,true);
 
       if (params.hasReached(nextSave))
       {
@@ -138,9 +155,14 @@ public:
         if (Newmark::opt.format >= 0)
           status += this->saveStep(iStep,pi->second);
 
-        // Save solution variables to HDF5
-        if (writer && !writer->dumpTimeLevel(&params))
-          status += 15;
+        // Save solution variables to HDF5. This only waits for a pending
+        // restart file write, since the HDF5 library is not thread-safe.
+        if (writer)
+        {
+          std::lock_guard<std::mutex> lock(output.hdf5Mutex());
+          if (!writer->dumpTimeLevel(&params))
+            status += 15;
+        }
 
         // Save solution variables to grid files, if specified
         if (!Newmark::model.saveResults(this->realSolution(),
@@ -152,17 +174,29 @@ public:
           nextSave = params.stopTime; // Always save the final step
       }
 
-      // Save solution state to restart file
+      // Save solution state to restart file.
+      // The state is serialized now, but written on the I/O thread.
       if (restart && restart->dumpStep(params))
       {
-        HDF5Restart::SerializeData data;
-        if (this->serialize(data) && !restart->writeData(data))
+        std::shared_ptr<HDF5Restart::SerializeData> data;
+        data.reset(new HDF5Restart::SerializeData());
+        std::mutex& h5mtx = output.hdf5Mutex();
+        auto&& task = [restart,data,&h5mtx]()
+        {
+          std::lock_guard<std::mutex> lock(h5mtx);
+          return restart->writeData(*data);
+        };
+        if (this->serialize(*data) && !output.push(task))
           status += 17;
       }
 
       utl::profiler->stop("Postprocessing");
     }
 
+    // Wait for the pending output tasks before closing the result file
+    if (!output.flush() && status == 0)
+      status = 17;
+
     if (os)
     {
       delete log;
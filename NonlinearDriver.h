@@ -65,11 +65,24 @@ protected:
   virtual void printNorms(const Vector& norm, utl::LogStream& os) const;
 
   //! \brief Adapts the mesh and restarts solution on new mesh.
+  //! \details The linear equation system, i.e., the sparsity pattern of the
+  //! tangent matrix and the symbolic factorization held by the equation
+  //! solver, is kept through all iterations and load steps. It is only
+  //! rebuilt here, and only if the mesh actually is refined. The assembly in
+  //! each iteration then only resets and refills the matrix values.
   bool adaptMesh(int& aStep);
 
   //! \brief Calculates and prints out interface force resultants.
   bool calcInterfaceForces(double t);
 
+  //! \brief Reads a full restart checkpoint from the restart file.
+  //! \param[in] run Identifier of the run that wrote the checkpoint
+  //! \param[in] dump Index of the full checkpoint within that run
+  //! \param[in] sum Expected checksum of the checkpoint
+  //! \param[out] data Container for serialized data
+  bool readFullDump(const std::string& run, int dump,
+                    const std::string& sum, SerializeMap& data) const;
+
 public:
   //! \brief Reads model data from the specified input file \a *fileName.
   virtual bool read(const char* fileName);
@@ -100,9 +113,26 @@ public:
 
   //! \brief Serialize solution state for restarting purposes.
   //! \param data Container for serialized data
+  //!
+  //! \details In incremental mode, only every \a nFullDump dump is a full
+  //! checkpoint. The other dumps store the solution vectors delta-encoded
+  //! relative to the last full checkpoint, and compressed with zlib.
+  //! Each dump holds the identifier of the run that wrote it and a checksum
+  //! of its state, and the incremental dumps also hold the checksum of their
+  //! full checkpoint.
+  //!
+  //! A copy of the last full checkpoint is kept in memory to encode against,
+  //! such that the incremental mode costs the size of one restart dump in
+  //! additional memory. It is not read back from the restart file, because
+  //! the restart output may be written asynchronously.
   virtual bool serialize(SerializeMap& data) const;
   //! \brief Set solution from a serialized state.
   //! \param[in] data Container for serialized data
+  //!
+  //! \details If \a data is an incremental dump, the full checkpoint it
+  //! refers to is read from the restart file, and the delta is applied to it.
+  //! The full checkpoint is identified by run and dump index, and both it
+  //! and the restored state are verified against their checksums.
   virtual bool deSerialize(const SerializeMap& data);
 
   //! \brief Accesses the projected solution.
@@ -133,8 +163,17 @@ private:
   Vector    myReacts;  //!< Reaction force container
   RealArray myWeights; //!< Nodal weights for iterface forces
 
+  int nFullDump; //!< Number of restart dumps per full checkpoint (0: all full)
+  mutable int nDump;    //!< Running restart dump counter
+  mutable int baseDump; //!< Index of the last full restart dump
+  mutable std::string runId; //!< Identifier of this run's restart dumps
+  //! \brief Copy of the last full restart dump, to delta-encode against.
+  //! \details This doubles the memory spent on restart data.
+  mutable SerializeMap lastFull;
+
   AdaptiveSetup* adap; //!< Data and methods for adaptive simulation
   std::string inpfile; //!< Model input file, used when adapting mesh
+  std::string inpxml;  //!< Model input file content, used when adapting mesh
 };
 
 #endif
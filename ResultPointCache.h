@@ -0,0 +1,105 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ResultPointCache.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Cache of linear result operators at fixed evaluation points.
+//!
+//==============================================================================
+
+#ifndef _RESULT_POINT_CACHE_H
+#define _RESULT_POINT_CACHE_H
+
+#include "MatVec.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+
+/*!
+  \brief Class representing a cache of result operators at fixed points.
+  \details For each evaluation point, identified by its element number and
+  parameter values, a matrix mapping the element solution vector onto the
+  secondary solution values is stored. A single column may also be used to
+  store the values for a fixed solution. The points are grouped by element,
+  such that points within the same element are looked up together.
+
+  The cache is shared by all threads, such that a point stored by one thread
+  is found also when a later pass evaluates the element on another thread.
+  The elements are distributed over a fixed number of shards, each guarded by
+  its own mutex, such that concurrent find() and store() invocations for
+  different elements seldom block each other. The total size of the cache can
+  be limited by a memory budget. Points that do not fit within the budget are
+  not cached, and have to be evaluated in full.
+*/
+
+class ResultPointCache
+{
+public:
+  //! \brief Default constructor.
+  ResultPointCache() : nShard(0), maxBytes(0), used(0), nHit(0), nMiss(0) {}
+
+  //! \brief Defines the memory budget and allocates the cache.
+  //! \param[in] mBytes Max size of the cache in MBytes (0 means unlimited)
+  //! \param[in] nel Expected number of elements, to pre-size the cache with
+  void setBudget(double mBytes, size_t nel = 0);
+  //! \brief Removes all cached points.
+  void clear();
+
+  //! \brief Returns \e true if the cache has not been allocated.
+  bool empty() const { return nShard == 0; }
+
+  //! \brief Returns a copy of the cached operator of a point, if any.
+  //! \param[in] iel Global element number (1-based)
+  //! \param[in] u Parameter values of the point
+  //! \param[out] S The result operator of the point
+  //! \return \e false on a cache miss
+  bool find(int iel, const double* u, Matrix& S) const;
+  //! \brief Stores the operator of a point.
+  //! \param[in] iel Global element number (1-based)
+  //! \param[in] u Parameter values of the point
+  //! \param[in] S The result operator of the point
+  //! \return \e false if the operator did not fit within the memory budget
+  bool store(int iel, const double* u, const Matrix& S);
+
+  //! \brief Returns the current size of the cache (in bytes).
+  size_t size() const { return used; }
+  //! \brief Returns the number of cache hits.
+  size_t hits() const { return nHit; }
+  //! \brief Returns the number of cache misses.
+  size_t misses() const { return nMiss; }
+
+private:
+  //! \brief Cached data of an evaluation point.
+  struct Point
+  {
+    double u[3]; //!< Parameter values of the point
+    Matrix S;    //!< Result operator of the point
+  };
+
+  //! \brief Points of each element, for a subset of the elements.
+  struct Shard
+  {
+    std::mutex lock; //!< Guards the points of this shard
+    std::unordered_map< int,std::vector<Point> > elms; //!< Element points
+  };
+
+  //! \brief Returns the shard holding the points of element \a iel.
+  Shard& shard(int iel) const { return shards[iel%nShard]; }
+
+  std::unique_ptr<Shard[]> shards; //!< Element shards of the cache
+  size_t nShard; //!< Number of shards
+
+  size_t maxBytes; //!< Memory budget in bytes (0 means unlimited)
+
+  std::atomic<size_t> used;          //!< Current cache size in bytes
+  mutable std::atomic<size_t> nHit;  //!< Number of cache hits
+  mutable std::atomic<size_t> nMiss; //!< Number of cache misses
+};
+
+#endif
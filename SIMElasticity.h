@@ -80,6 +80,31 @@ public:
   //! \brief Returns whether an analytical solution is available or not.
   virtual bool haveAnaSol() const;
 
+  //! \brief Returns the integration cost of each patch.
+  //! \param[out] cost Relative cost of each patch
+  //! \return \e true if measured costs are used, \e false if estimated
+  //!
+  //! \details The measured integrand times are used if they are available
+  //! for all patches, see GaussPointTimer. Otherwise, the cost is estimated
+  //! from the number of elements, element nodes and integration points, the
+  //! material type and the number of boundary terms of each patch.
+  bool getPatchCosts(RealArray& cost) const;
+  //! \brief Prints a distribution of the patches balancing their costs.
+  //! \param[in] nProc Number of processes to distribute the patches over
+  //!
+  //! \details The partitions are grown through the patch adjacency graph,
+  //! where the patches are linked by their shared nodes, such that both the
+  //! load imbalance and the number of interface nodes are kept low. This is
+  //! compared with the contiguous patch ranges minimizing the max cost of a
+  //! process. The partitioning is printed as a \a partitioning XML-block,
+  //! which can be inserted into the model input file of subsequent parallel
+  //! runs, together with the patch renumbering it requires, since this block
+  //! only assigns contiguous patch ranges to the processes.
+  //!
+  //! This method must be invoked in a serial run, since it needs all patches
+  //! of the model, whereas each process of a parallel run only has its own.
+  void printPartitioning(int nProc) const;
+
 protected:
   //! \brief Performs some preprocessing tasks before the FEM model generation.
   virtual void preprocessA();
@@ -91,6 +116,14 @@ protected:
   //! \brief Returns the actual integrand.
   virtual ElasticBase* getIntegrand() = 0;
 
+  //! \brief Detects groups of elements with identical stiffness matrices.
+  //! \details Two elements are regarded as equivalent if they have the same
+  //! homogeneous material, the same control point coordinates relative to
+  //! their first node, and the same basis, i.e., the same polynomial order,
+  //! scaled local knot vector and NURBS weights in each parameter direction.
+  //! Only tensor-product spline and Lagrange patches are considered.
+  void findEquivalentElements();
+
   //! \brief Parses the analytical solution from an input stream.
   virtual bool parseAnaSol(char*, std::istream&);
   //! \brief Parses the analytical solution from an XML element.
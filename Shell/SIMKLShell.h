@@ -17,6 +17,7 @@
 #include "SIMElasticity.h"
 #include "SIM2D.h"
 #include "Interface.h"
+#include "SpatialIndex.h"
 
 class KirchhoffLove;
 
@@ -135,6 +136,8 @@ protected:
   PloadVec  myLoads;  //!< Nodal/element point loads
   int       aCode[3]; //!< Analytical BC codes (used by destructor)
   LLdomain  lineLoad; //!< Domain definition of the line load
+
+  SpatialIndex myNodes; //!< Spatial index of the nodal points
 };
 
 
@@ -0,0 +1,88 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SpatialIndex.h
+//!
+//! \date Oct 14 2026
+//!
+//! \author IFEM Elasticity developers / SINTEF
+//!
+//! \brief Spatial index over the nodal points of a FE model.
+//!
+//==============================================================================
+
+#ifndef _SPATIAL_INDEX_H
+#define _SPATIAL_INDEX_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+class ASMbase;
+class Vec3;
+
+
+/*!
+  \brief Class representing a spatial index over the nodes of a FE model.
+  \details The nodal points of all patches are organized in a balanced kd-tree,
+  such that the closest node of a given point is found in logarithmic time,
+  instead of searching through all nodes of all patches. In addition, a map
+  from global node number to patch and local node number is kept, to avoid
+  searching the patches one by one for a given global node.
+
+  The index is built once from the patches of the model, typically in the
+  preprocessB() method of the simulator, and has to be rebuilt whenever the
+  mesh changes. It is based on the initial nodal coordinates.
+*/
+
+class SpatialIndex
+{
+public:
+  //! \brief Builds the index over the nodes of the given patches.
+  //! \param[in] model The patches of the FE model
+  void build(const std::vector<ASMbase*>& model);
+  //! \brief Removes all nodes from the index.
+  void clear();
+
+  //! \brief Returns \e true if the index has not been built.
+  bool empty() const { return nodes.empty(); }
+
+  //! \brief Shifts the global node numbers by a constant offset.
+  //! \details This is used when the global node numbers of the model are
+  //! shifted after preprocessing, e.g., in coupled multi-model simulations.
+  void shiftGlobalNums(int nshift);
+
+  //! \brief Finds the node closest to a given point.
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[out] dist Distance from the point to the closest node
+  //! \return Global number of the closest node, 0 if the index is empty
+  int findClosestNode(const Vec3& X, double* dist = nullptr) const;
+
+  //! \brief Finds the patch containing a given global node.
+  //! \param[in] inod Global node number (1-based)
+  //! \param[out] node Local node number within the patch (1-based)
+  //! \return 1-based index of the patch, 0 if the node is not found
+  size_t findNode(int inod, size_t& node) const;
+
+private:
+  //! \brief Nodal point data.
+  struct Node
+  {
+    double X[3]; //!< Nodal coordinates
+    int    id;   //!< Global node number
+    char   ax;   //!< Splitting direction of this kd-tree node
+  };
+
+  //! \brief Recursively builds the kd-tree of the nodes in [\a lo, \a hi).
+  void split(size_t lo, size_t hi);
+  //! \brief Recursively searches the kd-tree of the nodes in [\a lo, \a hi).
+  void search(const double* X, size_t lo, size_t hi,
+              size_t& best, double& d2) const;
+
+  std::vector<Node> nodes; //!< Nodal points in kd-tree order
+
+  //! \brief Patch index and local node number of each global node
+  std::unordered_map< int,std::pair<size_t,size_t> > nodeMap;
+};
+
+#endif